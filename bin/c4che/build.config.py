@@ -0,0 +1,2 @@
+version = 0x105019
+tools = [{'tool': 'gnu_dirs', 'tooldir': None, 'funs': None}, {'tool': 'wafsamba', 'tooldir': None, 'funs': None}, {'tool': 'ar', 'tooldir': None, 'funs': None}, {'tool': 'cc', 'tooldir': None, 'funs': None}, {'tool': 'gcc', 'tooldir': None, 'funs': None}, {'tool': 'compiler_cc', 'tooldir': None, 'funs': None}, {'tool': 'gccdeps', 'tooldir': ['/root/repo/buildtools/wafsamba'], 'funs': None}, {'tool': 'python', 'tooldir': None, 'funs': None}, {'tool': 'perl', 'tooldir': None, 'funs': None}]
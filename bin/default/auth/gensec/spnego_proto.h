@@ -0,0 +1,19 @@
+#ifndef __DEFAULT_AUTH_GENSEC_SPNEGO_PROTO_H__
+#define __DEFAULT_AUTH_GENSEC_SPNEGO_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../auth/gensec/spnego.c  */
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_AUTH_GENSEC_SPNEGO_PROTO_H__ */
+
@@ -0,0 +1,15 @@
+/* Autogenerated by waf */
+#define SAMBA_VERSION_MAJOR 4
+#define SAMBA_VERSION_MINOR 0
+#define SAMBA_VERSION_RELEASE 0
+#define SAMBA_VERSION_ALPHA_RELEASE 20
+#define SAMBA_VERSION_OFFICIAL_STRING "4.0.0alpha20-DEVELOPERBUILD"
+
+#ifdef SAMBA_VERSION_VENDOR_FUNCTION
+#  define SAMBA_VERSION_STRING SAMBA_VERSION_VENDOR_FUNCTION
+#else /* SAMBA_VERSION_VENDOR_FUNCTION */
+#  define SAMBA_VERSION_STRING "4.0.0alpha20-DEVELOPERBUILD"
+#endif
+/* Version for mkrelease.sh: 
+SAMBA_VERSION_STRING=4.0.0alpha20-DEVELOPERBUILD
+ */
@@ -0,0 +1,106 @@
+#ifndef __DEFAULT_LIB_PARAM_PARAM_GLOBAL_H__
+#define __DEFAULT_LIB_PARAM_PARAM_GLOBAL_H__
+
+/* This file was automatically generated by mkparamdefs.pl. DO NOT EDIT */
+
+/**
+ * This structure describes global (ie., server-wide) parameters.
+ */
+struct loadparm_global 
+{
+	const char **  smb_ports;
+	int   nbt_port;
+	int   dgram_port;
+	int   cldap_port;
+	int   krb5_port;
+	int   kpasswd_port;
+	int   web_port;
+	bool   tls_enabled;
+	char *  logfile;
+	char *  szShareBackend;
+	char *  szWinbindSeparator;
+	char *  szWinbinddSocketDirectory;
+	char *  szWinbinddPrivilegedSocketDirectory;
+	char *  szTemplateShell;
+	char *  szTemplateHomedir;
+	bool   bWinbindSealedPipes;
+	bool   bIdmapTrustedOnly;
+	char *  szPrivateDir;
+	char *  szServerString;
+	char *  szLockDir;
+	char *  szStateDir;
+	char *  szCacheDir;
+	char *  ncalrpc_dir;
+	char *  dos_charset;
+	char *  unix_charset;
+	char *  szPidDir;
+	const char **  szRNDCCommand;
+	const char **  szDNSUpdateCommand;
+	const char **  szSPNUpdateCommand;
+	const char **  szSambaKCCCommand;
+	const char **  szNSUpdateCommand;
+	const char **  dcerpc_ep_servers;
+	const char **  server_services;
+	char *  ntptr_providor;
+	char *  passdb_backend;
+	char *  szAutoServices;
+	char *  szPasswdChat;
+	const char **  szPasswordServers;
+	const char **  szNameResolveOrder;
+	char *  szRealm_upper;
+	char *  szRealm_lower;
+	char *  socket_options;
+	char *  szWorkgroup;
+	char *  szNetbiosName;
+	char *  szNetbiosScope;
+	const char **  szWINSservers;
+	const char **  szInterfaces;
+	char *  szSocketAddress;
+	const char **  szNetbiosAliases;
+	bool   bDisableNetbios;
+	bool   bWINSsupport;
+	bool   bWINSdnsProxy;
+	char *  szWINSHook;
+	bool   bLocalMaster;
+	bool   bReadRaw;
+	bool   bLargeReadwrite;
+	bool   bWriteRaw;
+	bool   bNullPasswords;
+	bool   bObeyPamRestrictions;
+	bool   bEncryptPasswords;
+	bool   bTimeServer;
+	bool   bBindInterfacesOnly;
+	bool   bUnicode;
+	bool   bNTStatusSupport;
+	bool   bLanmanAuth;
+	bool   bNTLMAuth;
+	bool   bClientPlaintextAuth;
+	bool   bClientLanManAuth;
+	bool   bClientNTLMv2Auth;
+	bool   client_use_spnego_principal;
+	bool   bHostMSDfs;
+	bool   bUnixExtensions;
+	bool   bUseSpnego;
+	bool   bUseMmap;
+	bool   bRpcBigEndian;
+	int   max_wins_ttl;
+	int   min_wins_ttl;
+	int   max_mux;
+	int   max_xmit;
+	int   pwordlevel;
+	int   srv_maxprotocol;
+	int   srv_minprotocol;
+	int   cli_maxprotocol;
+	int   cli_minprotocol;
+	bool   paranoid_server_security;
+	int   allow_dns_updates;
+	char *  dns_forwarder;
+	bool   dns_recursive_queries;
+	int   server_signing;
+	int   client_signing;
+	char *  szNTPSignDSocketDirectory;
+LOADPARM_EXTRA_GLOBALS
+};
+
+#endif /* __DEFAULT_LIB_PARAM_PARAM_GLOBAL_H__ */
+
@@ -0,0 +1,113 @@
+#ifndef __DEFAULT_LIB_PARAM_S3_PARAM_H__
+#define __DEFAULT_LIB_PARAM_S3_PARAM_H__
+
+/* This file was automatically generated by mks3param.pl. DO NOT EDIT */
+
+struct loadparm_s3_context
+{
+	const char * (*get_parametric)(struct loadparm_service *, const char *type, const char *option);
+	struct parm_struct * (*get_parm_struct)(const char *param_name);
+	void * (*get_parm_ptr)(struct loadparm_service *service, struct parm_struct *parm);
+	struct loadparm_service * (*get_service)(const char *service_name);
+	struct loadparm_service * (*get_default_loadparm_service)(void);
+	struct loadparm_service * (*get_servicebynum)(int snum);
+	int (*get_numservices)(void);
+	bool (*load)(const char *filename);
+	bool (*set_cmdline)(const char *pszParmName, const char *pszParmValue);
+	void (*dump)(FILE *f, bool show_defaults, int maxtoprint);
+	int (*server_role)(void);
+	int (*security)(void);
+	const char ** (*smb_ports)(void);
+	int  (*nbt_port)(void);
+	int  (*dgram_port)(void);
+	int  (*cldap_port)(void);
+	int  (*krb5_port)(void);
+	int  (*kpasswd_port)(void);
+	int  (*web_port)(void);
+	bool  (*tls_enabled)(void);
+	const char * (*logfile)(void);
+	const char * (*share_backend)(void);
+	const char * (*winbind_separator)(void);
+	const char * (*winbindd_socket_directory)(void);
+	const char * (*winbindd_privileged_socket_directory)(void);
+	const char * (*template_shell)(void);
+	const char * (*template_homedir)(void);
+	bool  (*winbind_sealed_pipes)(void);
+	bool  (*idmap_trusted_only)(void);
+	const char * (*private_dir)(void);
+	const char * (*serverstring)(void);
+	const char * (*lockdir)(void);
+	const char * (*statedir)(void);
+	const char * (*cachedir)(void);
+	const char * (*ncalrpc_dir)(void);
+	const char * (*dos_charset)(void);
+	const char * (*unix_charset)(void);
+	const char * (*piddir)(void);
+	const char ** (*rndc_command)(void);
+	const char ** (*dns_update_command)(void);
+	const char ** (*spn_update_command)(void);
+	const char ** (*samba_kcc_command)(void);
+	const char ** (*nsupdate_command)(void);
+	const char ** (*dcerpc_endpoint_servers)(void);
+	const char ** (*server_services)(void);
+	const char * (*ntptr_providor)(void);
+	const char * (*passdb_backend)(void);
+	const char * (*auto_services)(void);
+	const char * (*passwd_chat)(void);
+	const char ** (*passwordserver)(void);
+	const char ** (*name_resolve_order)(void);
+	const char * (*realm)(void);
+	const char * (*dnsdomain)(void);
+	const char * (*socket_options)(void);
+	const char * (*workgroup)(void);
+	const char * (*netbios_name)(void);
+	const char * (*netbios_scope)(void);
+	const char ** (*wins_server_list)(void);
+	const char ** (*interfaces)(void);
+	const char * (*socket_address)(void);
+	const char ** (*netbios_aliases)(void);
+	bool  (*disable_netbios)(void);
+	bool  (*we_are_a_wins_server)(void);
+	bool  (*wins_dns_proxy)(void);
+	const char * (*wins_hook)(void);
+	bool  (*local_master)(void);
+	bool  (*readraw)(void);
+	bool  (*large_readwrite)(void);
+	bool  (*writeraw)(void);
+	bool  (*null_passwords)(void);
+	bool  (*obey_pam_restrictions)(void);
+	bool  (*encrypted_passwords)(void);
+	bool  (*time_server)(void);
+	bool  (*bind_interfaces_only)(void);
+	bool  (*unicode)(void);
+	bool  (*nt_status_support)(void);
+	bool  (*lanman_auth)(void);
+	bool  (*ntlm_auth)(void);
+	bool  (*client_plaintext_auth)(void);
+	bool  (*client_lanman_auth)(void);
+	bool  (*client_ntlmv2_auth)(void);
+	bool  (*client_use_spnego_principal)(void);
+	bool  (*host_msdfs)(void);
+	bool  (*unix_extensions)(void);
+	bool  (*use_spnego)(void);
+	bool  (*use_mmap)(void);
+	bool  (*rpc_big_endian)(void);
+	int  (*max_wins_ttl)(void);
+	int  (*min_wins_ttl)(void);
+	int  (*maxmux)(void);
+	int  (*max_xmit)(void);
+	int  (*passwordlevel)(void);
+	int  (*srv_maxprotocol)(void);
+	int  (*srv_minprotocol)(void);
+	int  (*cli_maxprotocol)(void);
+	int  (*cli_minprotocol)(void);
+	bool  (*paranoid_server_security)(void);
+	int  (*allow_dns_updates)(void);
+	const char * (*dns_forwarder)(void);
+	bool  (*dns_recursive_queries)(void);
+	int  (*server_signing)(void);
+	int  (*client_signing)(void);
+	const char * (*ntp_signd_socket_directory)(void);
+};
+#endif /* __DEFAULT_LIB_PARAM_S3_PARAM_H__ */
+
@@ -0,0 +1,19 @@
+/* header auto-generated by pidl */
+
+#ifndef _PIDL_HEADER_dbgidl
+#define _PIDL_HEADER_dbgidl
+
+#include <stdint.h>
+
+#include "libcli/util/ntstatus.h"
+
+#ifndef _HEADER_dbgidl
+#define _HEADER_dbgidl
+
+
+struct dummy_dbgidl {
+	int _dummy_element;
+};
+
+#endif /* _HEADER_dbgidl */
+#endif /* _PIDL_HEADER_dbgidl */
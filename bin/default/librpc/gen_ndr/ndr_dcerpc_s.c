@@ -0,0 +1,5 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_dcerpc.h"
+
+NTSTATUS dcerpc_server_dcerpc_init(void);
+
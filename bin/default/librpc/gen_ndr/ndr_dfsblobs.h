@@ -0,0 +1,38 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/dfsblobs.h"
+
+#ifndef _HEADER_NDR_dfsblobs
+#define _HEADER_NDR_dfsblobs
+
+#define NDR_DFSBLOBS_UUID "12345778-1234-abcd-0001-00000003"
+#define NDR_DFSBLOBS_VERSION 0.0
+#define NDR_DFSBLOBS_NAME "dfsblobs"
+#define NDR_DFSBLOBS_HELPSTRING "dfs referral blobs"
+extern const struct ndr_interface_table ndr_table_dfsblobs;
+#define NDR_DFS_GETDFSREFERRAL (0x00)
+
+#define NDR_DFSBLOBS_CALL_COUNT (1)
+void ndr_print_DFS_HEADER_FLAG(struct ndr_print *ndr, const char *name, uint32_t r);
+void ndr_print_DFS_SERVER_TYPE(struct ndr_print *ndr, const char *name, enum DFS_SERVER_TYPE r);
+void ndr_print_DFS_FLAGS_REFERRAL(struct ndr_print *ndr, const char *name, enum DFS_FLAGS_REFERRAL r);
+void ndr_print_dfs_referral_v1(struct ndr_print *ndr, const char *name, const struct dfs_referral_v1 *r);
+void ndr_print_dfs_referral_v2(struct ndr_print *ndr, const char *name, const struct dfs_referral_v2 *r);
+void ndr_print_dfs_normal_referral(struct ndr_print *ndr, const char *name, const struct dfs_normal_referral *r);
+void ndr_print_dfs_domain_referral(struct ndr_print *ndr, const char *name, const struct dfs_domain_referral *r);
+void ndr_print_dfs_referral(struct ndr_print *ndr, const char *name, const union dfs_referral *r);
+void ndr_print_dfs_padding(struct ndr_print *ndr, const char *name, const union dfs_padding *r);
+void ndr_print_dfs_referral_v3(struct ndr_print *ndr, const char *name, const struct dfs_referral_v3 *r);
+void ndr_print_dfs_referral_version(struct ndr_print *ndr, const char *name, const union dfs_referral_version *r);
+void ndr_print_dfs_referral_type(struct ndr_print *ndr, const char *name, const struct dfs_referral_type *r);
+enum ndr_err_code ndr_push_dfs_referral_resp(struct ndr_push *ndr, int ndr_flags, const struct dfs_referral_resp *r);
+enum ndr_err_code ndr_pull_dfs_referral_resp(struct ndr_pull *ndr, int ndr_flags, struct dfs_referral_resp *r);
+void ndr_print_dfs_referral_resp(struct ndr_print *ndr, const char *name, const struct dfs_referral_resp *r);
+enum ndr_err_code ndr_push_dfs_GetDFSReferral_in(struct ndr_push *ndr, int ndr_flags, const struct dfs_GetDFSReferral_in *r);
+enum ndr_err_code ndr_pull_dfs_GetDFSReferral_in(struct ndr_pull *ndr, int ndr_flags, struct dfs_GetDFSReferral_in *r);
+void ndr_print_dfs_GetDFSReferral_in(struct ndr_print *ndr, const char *name, const struct dfs_GetDFSReferral_in *r);
+enum ndr_err_code ndr_push_dfs_GetDFSReferral(struct ndr_push *ndr, int flags, const struct dfs_GetDFSReferral *r);
+enum ndr_err_code ndr_pull_dfs_GetDFSReferral(struct ndr_pull *ndr, int flags, struct dfs_GetDFSReferral *r);
+void ndr_print_dfs_GetDFSReferral(struct ndr_print *ndr, const char *name, int flags, const struct dfs_GetDFSReferral *r);
+#endif /* _HEADER_NDR_dfsblobs */
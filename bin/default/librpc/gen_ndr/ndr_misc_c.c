@@ -0,0 +1,10 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_misc.h"
+#include "bin/default/librpc/gen_ndr/ndr_misc_c.h"
+
+/* misc - client functions generated by pidl */
+
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/misc.h"
+#ifndef _HEADER_RPC_misc
+#define _HEADER_RPC_misc
+
+#endif /* _HEADER_RPC_misc */
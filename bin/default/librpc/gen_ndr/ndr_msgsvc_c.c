@@ -0,0 +1,12 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_msgsvc.h"
+#include "bin/default/librpc/gen_ndr/ndr_msgsvc_c.h"
+
+/* msgsvc - client functions generated by pidl */
+
+/* msgsvcsend - client functions generated by pidl */
+
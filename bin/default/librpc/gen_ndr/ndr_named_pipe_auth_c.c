@@ -0,0 +1,10 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_named_pipe_auth.h"
+#include "bin/default/librpc/gen_ndr/ndr_named_pipe_auth_c.h"
+
+/* named_pipe_auth - client functions generated by pidl */
+
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/orpc.h"
+#ifndef _HEADER_RPC_ObjectRpcBaseTypes
+#define _HEADER_RPC_ObjectRpcBaseTypes
+
+#endif /* _HEADER_RPC_ObjectRpcBaseTypes */
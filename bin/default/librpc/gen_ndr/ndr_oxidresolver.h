@@ -0,0 +1,34 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/oxidresolver.h"
+
+#ifndef _HEADER_NDR_IOXIDResolver
+#define _HEADER_NDR_IOXIDResolver
+
+#define NDR_IOXIDRESOLVER_UUID "99fcfec4-5260-101b-bbcb-00aa0021347a"
+#define NDR_IOXIDRESOLVER_VERSION 0.0
+#define NDR_IOXIDRESOLVER_NAME "IOXIDResolver"
+#define NDR_IOXIDRESOLVER_HELPSTRING "Object Exporter ID Resolver"
+extern const struct ndr_interface_table ndr_table_IOXIDResolver;
+#define NDR_RESOLVEOXID (0x00)
+
+#define NDR_SIMPLEPING (0x01)
+
+#define NDR_COMPLEXPING (0x02)
+
+#define NDR_SERVERALIVE (0x03)
+
+#define NDR_RESOLVEOXID2 (0x04)
+
+#define NDR_SERVERALIVE2 (0x05)
+
+#define NDR_IOXIDRESOLVER_CALL_COUNT (6)
+void ndr_print_COMINFO(struct ndr_print *ndr, const char *name, const struct COMINFO *r);
+void ndr_print_ResolveOxid(struct ndr_print *ndr, const char *name, int flags, const struct ResolveOxid *r);
+void ndr_print_SimplePing(struct ndr_print *ndr, const char *name, int flags, const struct SimplePing *r);
+void ndr_print_ComplexPing(struct ndr_print *ndr, const char *name, int flags, const struct ComplexPing *r);
+void ndr_print_ServerAlive(struct ndr_print *ndr, const char *name, int flags, const struct ServerAlive *r);
+void ndr_print_ResolveOxid2(struct ndr_print *ndr, const char *name, int flags, const struct ResolveOxid2 *r);
+void ndr_print_ServerAlive2(struct ndr_print *ndr, const char *name, int flags, const struct ServerAlive2 *r);
+#endif /* _HEADER_NDR_IOXIDResolver */
@@ -0,0 +1,14 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/printcap.h"
+
+#ifndef _HEADER_NDR_printcap
+#define _HEADER_NDR_printcap
+
+#define NDR_PRINTCAP_CALL_COUNT (0)
+void ndr_print_pcap_printer(struct ndr_print *ndr, const char *name, const struct pcap_printer *r);
+enum ndr_err_code ndr_push_pcap_data(struct ndr_push *ndr, int ndr_flags, const struct pcap_data *r);
+enum ndr_err_code ndr_pull_pcap_data(struct ndr_pull *ndr, int ndr_flags, struct pcap_data *r);
+void ndr_print_pcap_data(struct ndr_print *ndr, const char *name, const struct pcap_data *r);
+#endif /* _HEADER_NDR_printcap */
@@ -0,0 +1,10 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_printcap.h"
+#include "bin/default/librpc/gen_ndr/ndr_printcap_c.h"
+
+/* printcap - client functions generated by pidl */
+
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/printcap.h"
+#ifndef _HEADER_RPC_printcap
+#define _HEADER_RPC_printcap
+
+#endif /* _HEADER_RPC_printcap */
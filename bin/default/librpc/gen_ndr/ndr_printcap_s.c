@@ -0,0 +1,5 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_printcap.h"
+
+NTSTATUS dcerpc_server_printcap_init(void);
+
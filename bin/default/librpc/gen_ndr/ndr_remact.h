@@ -0,0 +1,18 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/remact.h"
+
+#ifndef _HEADER_NDR_IRemoteActivation
+#define _HEADER_NDR_IRemoteActivation
+
+#define NDR_IREMOTEACTIVATION_UUID "4d9f4ab8-7d1c-11cf-861e-0020af6e7c57"
+#define NDR_IREMOTEACTIVATION_VERSION 0.0
+#define NDR_IREMOTEACTIVATION_NAME "IRemoteActivation"
+#define NDR_IREMOTEACTIVATION_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IRemoteActivation;
+#define NDR_REMOTEACTIVATION (0x00)
+
+#define NDR_IREMOTEACTIVATION_CALL_COUNT (1)
+void ndr_print_RemoteActivation(struct ndr_print *ndr, const char *name, int flags, const struct RemoteActivation *r);
+#endif /* _HEADER_NDR_IRemoteActivation */
@@ -0,0 +1,10 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_security.h"
+#include "bin/default/librpc/gen_ndr/ndr_security_c.h"
+
+/* security - client functions generated by pidl */
+
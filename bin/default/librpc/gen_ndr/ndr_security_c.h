@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/security.h"
+#ifndef _HEADER_RPC_security
+#define _HEADER_RPC_security
+
+#endif /* _HEADER_RPC_security */
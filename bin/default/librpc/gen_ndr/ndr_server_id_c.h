@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/server_id.h"
+#ifndef _HEADER_RPC_server_id
+#define _HEADER_RPC_server_id
+
+#endif /* _HEADER_RPC_server_id */
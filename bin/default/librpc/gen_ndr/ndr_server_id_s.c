@@ -0,0 +1,5 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_server_id.h"
+
+NTSTATUS dcerpc_server_server_id_init(void);
+
@@ -0,0 +1,267 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/wmi.h"
+
+#ifndef _HEADER_NDR_IWbemClassObject
+#define _HEADER_NDR_IWbemClassObject
+
+#define NDR_IWBEMCLASSOBJECT_UUID "dc12a681-737f-11cf-884d-00aa004b2e24"
+#define NDR_IWBEMCLASSOBJECT_VERSION 0.0
+#define NDR_IWBEMCLASSOBJECT_NAME "IWbemClassObject"
+#define NDR_IWBEMCLASSOBJECT_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IWbemClassObject;
+#define NDR_DELETE (0x00)
+
+#define NDR_IWBEMCLASSOBJECT_CALL_COUNT (1)
+void ndr_print_BSTR(struct ndr_print *ndr, const char *name, const struct BSTR *r);
+void ndr_print_Delete(struct ndr_print *ndr, const char *name, int flags, const struct Delete *r);
+#endif /* _HEADER_NDR_IWbemClassObject */
+#ifndef _HEADER_NDR_IWbemServices
+#define _HEADER_NDR_IWbemServices
+
+#define NDR_IWBEMSERVICES_UUID "9556dc99-828c-11cf-a37e-00aa003240c7"
+#define NDR_IWBEMSERVICES_VERSION 0.0
+#define NDR_IWBEMSERVICES_NAME "IWbemServices"
+#define NDR_IWBEMSERVICES_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IWbemServices;
+#define NDR_OPENNAMESPACE (0x00)
+
+#define NDR_CANCELASYNCCALL (0x01)
+
+#define NDR_QUERYOBJECTSINK (0x02)
+
+#define NDR_GETOBJECT (0x03)
+
+#define NDR_GETOBJECTASYNC (0x04)
+
+#define NDR_PUTCLASS (0x05)
+
+#define NDR_PUTCLASSASYNC (0x06)
+
+#define NDR_DELETECLASS (0x07)
+
+#define NDR_DELETECLASSASYNC (0x08)
+
+#define NDR_CREATECLASSENUM (0x09)
+
+#define NDR_CREATECLASSENUMASYNC (0x0a)
+
+#define NDR_PUTINSTANCE (0x0b)
+
+#define NDR_PUTINSTANCEASYNC (0x0c)
+
+#define NDR_DELETEINSTANCE (0x0d)
+
+#define NDR_DELETEINSTANCEASYNC (0x0e)
+
+#define NDR_CREATEINSTANCEENUM (0x0f)
+
+#define NDR_CREATEINSTANCEENUMASYNC (0x10)
+
+#define NDR_EXECQUERY (0x11)
+
+#define NDR_EXECQUERYASYNC (0x12)
+
+#define NDR_EXECNOTIFICATIONQUERY (0x13)
+
+#define NDR_EXECNOTIFICATIONQUERYASYNC (0x14)
+
+#define NDR_EXECMETHOD (0x15)
+
+#define NDR_EXECMETHODASYNC (0x16)
+
+#define NDR_IWBEMSERVICES_CALL_COUNT (23)
+enum ndr_err_code ndr_push_WBEM_GENERIC_FLAG_TYPE(struct ndr_push *ndr, int ndr_flags, uint32_t r);
+enum ndr_err_code ndr_pull_WBEM_GENERIC_FLAG_TYPE(struct ndr_pull *ndr, int ndr_flags, uint32_t *r);
+void ndr_print_WBEM_GENERIC_FLAG_TYPE(struct ndr_print *ndr, const char *name, uint32_t r);
+enum ndr_err_code ndr_push_WBEM_TIMEOUT_TYPE(struct ndr_push *ndr, int ndr_flags, enum WBEM_TIMEOUT_TYPE r);
+enum ndr_err_code ndr_pull_WBEM_TIMEOUT_TYPE(struct ndr_pull *ndr, int ndr_flags, enum WBEM_TIMEOUT_TYPE *r);
+void ndr_print_WBEM_TIMEOUT_TYPE(struct ndr_print *ndr, const char *name, enum WBEM_TIMEOUT_TYPE r);
+enum ndr_err_code ndr_push_CIMTYPE_ENUMERATION(struct ndr_push *ndr, int ndr_flags, enum CIMTYPE_ENUMERATION r);
+enum ndr_err_code ndr_pull_CIMTYPE_ENUMERATION(struct ndr_pull *ndr, int ndr_flags, enum CIMTYPE_ENUMERATION *r);
+void ndr_print_CIMTYPE_ENUMERATION(struct ndr_print *ndr, const char *name, enum CIMTYPE_ENUMERATION r);
+enum ndr_err_code ndr_push_WBEM_FLAVOR_TYPE(struct ndr_push *ndr, int ndr_flags, uint8_t r);
+enum ndr_err_code ndr_pull_WBEM_FLAVOR_TYPE(struct ndr_pull *ndr, int ndr_flags, uint8_t *r);
+void ndr_print_WBEM_FLAVOR_TYPE(struct ndr_print *ndr, const char *name, uint8_t r);
+enum ndr_err_code ndr_push_WCO_FLAGS(struct ndr_push *ndr, int ndr_flags, uint8_t r);
+enum ndr_err_code ndr_pull_WCO_FLAGS(struct ndr_pull *ndr, int ndr_flags, uint8_t *r);
+void ndr_print_WCO_FLAGS(struct ndr_print *ndr, const char *name, uint8_t r);
+enum ndr_err_code ndr_push_DEFAULT_FLAGS(struct ndr_push *ndr, int ndr_flags, uint8_t r);
+enum ndr_err_code ndr_pull_DEFAULT_FLAGS(struct ndr_pull *ndr, int ndr_flags, uint8_t *r);
+void ndr_print_DEFAULT_FLAGS(struct ndr_print *ndr, const char *name, uint8_t r);
+void ndr_print_OpenNamespace(struct ndr_print *ndr, const char *name, int flags, const struct OpenNamespace *r);
+void ndr_print_CancelAsyncCall(struct ndr_print *ndr, const char *name, int flags, const struct CancelAsyncCall *r);
+void ndr_print_QueryObjectSink(struct ndr_print *ndr, const char *name, int flags, const struct QueryObjectSink *r);
+void ndr_print_GetObject(struct ndr_print *ndr, const char *name, int flags, const struct GetObject *r);
+void ndr_print_GetObjectAsync(struct ndr_print *ndr, const char *name, int flags, const struct GetObjectAsync *r);
+void ndr_print_PutClass(struct ndr_print *ndr, const char *name, int flags, const struct PutClass *r);
+void ndr_print_PutClassAsync(struct ndr_print *ndr, const char *name, int flags, const struct PutClassAsync *r);
+void ndr_print_DeleteClass(struct ndr_print *ndr, const char *name, int flags, const struct DeleteClass *r);
+void ndr_print_DeleteClassAsync(struct ndr_print *ndr, const char *name, int flags, const struct DeleteClassAsync *r);
+void ndr_print_CreateClassEnum(struct ndr_print *ndr, const char *name, int flags, const struct CreateClassEnum *r);
+void ndr_print_CreateClassEnumAsync(struct ndr_print *ndr, const char *name, int flags, const struct CreateClassEnumAsync *r);
+void ndr_print_PutInstance(struct ndr_print *ndr, const char *name, int flags, const struct PutInstance *r);
+void ndr_print_PutInstanceAsync(struct ndr_print *ndr, const char *name, int flags, const struct PutInstanceAsync *r);
+void ndr_print_DeleteInstance(struct ndr_print *ndr, const char *name, int flags, const struct DeleteInstance *r);
+void ndr_print_DeleteInstanceAsync(struct ndr_print *ndr, const char *name, int flags, const struct DeleteInstanceAsync *r);
+void ndr_print_CreateInstanceEnum(struct ndr_print *ndr, const char *name, int flags, const struct CreateInstanceEnum *r);
+void ndr_print_CreateInstanceEnumAsync(struct ndr_print *ndr, const char *name, int flags, const struct CreateInstanceEnumAsync *r);
+void ndr_print_ExecQuery(struct ndr_print *ndr, const char *name, int flags, const struct ExecQuery *r);
+void ndr_print_ExecQueryAsync(struct ndr_print *ndr, const char *name, int flags, const struct ExecQueryAsync *r);
+void ndr_print_ExecNotificationQuery(struct ndr_print *ndr, const char *name, int flags, const struct ExecNotificationQuery *r);
+void ndr_print_ExecNotificationQueryAsync(struct ndr_print *ndr, const char *name, int flags, const struct ExecNotificationQueryAsync *r);
+void ndr_print_ExecMethod(struct ndr_print *ndr, const char *name, int flags, const struct ExecMethod *r);
+void ndr_print_ExecMethodAsync(struct ndr_print *ndr, const char *name, int flags, const struct ExecMethodAsync *r);
+#endif /* _HEADER_NDR_IWbemServices */
+#ifndef _HEADER_NDR_IEnumWbemClassObject
+#define _HEADER_NDR_IEnumWbemClassObject
+
+#define NDR_IENUMWBEMCLASSOBJECT_UUID "027947e1-d731-11ce-a357-000000000001"
+#define NDR_IENUMWBEMCLASSOBJECT_VERSION 0.0
+#define NDR_IENUMWBEMCLASSOBJECT_NAME "IEnumWbemClassObject"
+#define NDR_IENUMWBEMCLASSOBJECT_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IEnumWbemClassObject;
+#define NDR_RESET (0x00)
+
+#define NDR_IENUMWBEMCLASSOBJECT_NEXT (0x01)
+
+#define NDR_NEXTASYNC (0x02)
+
+#define NDR_IENUMWBEMCLASSOBJECT_CLONE (0x03)
+
+#define NDR_SKIP (0x04)
+
+#define NDR_IENUMWBEMCLASSOBJECT_CALL_COUNT (5)
+void ndr_print_Reset(struct ndr_print *ndr, const char *name, int flags, const struct Reset *r);
+void ndr_print_IEnumWbemClassObject_Next(struct ndr_print *ndr, const char *name, int flags, const struct IEnumWbemClassObject_Next *r);
+void ndr_print_NextAsync(struct ndr_print *ndr, const char *name, int flags, const struct NextAsync *r);
+void ndr_print_IEnumWbemClassObject_Clone(struct ndr_print *ndr, const char *name, int flags, const struct IEnumWbemClassObject_Clone *r);
+void ndr_print_Skip(struct ndr_print *ndr, const char *name, int flags, const struct Skip *r);
+#endif /* _HEADER_NDR_IEnumWbemClassObject */
+#ifndef _HEADER_NDR_IWbemContext
+#define _HEADER_NDR_IWbemContext
+
+#define NDR_IWBEMCONTEXT_UUID "44aca674-e8fc-11d0-a07c-00c04fb68820"
+#define NDR_IWBEMCONTEXT_VERSION 0.0
+#define NDR_IWBEMCONTEXT_NAME "IWbemContext"
+#define NDR_IWBEMCONTEXT_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IWbemContext;
+#define NDR_CLONE (0x00)
+
+#define NDR_GETNAMES (0x01)
+
+#define NDR_BEGINENUMERATION (0x02)
+
+#define NDR_NEXT (0x03)
+
+#define NDR_ENDENUMERATION (0x04)
+
+#define NDR_SETVALUE (0x05)
+
+#define NDR_GETVALUE (0x06)
+
+#define NDR_DELETEVALUE (0x07)
+
+#define NDR_DELETEALL (0x08)
+
+#define NDR_IWBEMCONTEXT_CALL_COUNT (9)
+void ndr_print_Clone(struct ndr_print *ndr, const char *name, int flags, const struct Clone *r);
+void ndr_print_GetNames(struct ndr_print *ndr, const char *name, int flags, const struct GetNames *r);
+void ndr_print_BeginEnumeration(struct ndr_print *ndr, const char *name, int flags, const struct BeginEnumeration *r);
+void ndr_print_Next(struct ndr_print *ndr, const char *name, int flags, const struct Next *r);
+void ndr_print_EndEnumeration(struct ndr_print *ndr, const char *name, int flags, const struct EndEnumeration *r);
+void ndr_print_SetValue(struct ndr_print *ndr, const char *name, int flags, const struct SetValue *r);
+void ndr_print_GetValue(struct ndr_print *ndr, const char *name, int flags, const struct GetValue *r);
+void ndr_print_DeleteValue(struct ndr_print *ndr, const char *name, int flags, const struct DeleteValue *r);
+void ndr_print_DeleteAll(struct ndr_print *ndr, const char *name, int flags, const struct DeleteAll *r);
+#endif /* _HEADER_NDR_IWbemContext */
+#ifndef _HEADER_NDR_IWbemLevel1Login
+#define _HEADER_NDR_IWbemLevel1Login
+
+#define NDR_IWBEMLEVEL1LOGIN_UUID "f309ad18-d86a-11d0-a075-00c04fb68820"
+#define NDR_IWBEMLEVEL1LOGIN_VERSION 0.0
+#define NDR_IWBEMLEVEL1LOGIN_NAME "IWbemLevel1Login"
+#define NDR_IWBEMLEVEL1LOGIN_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IWbemLevel1Login;
+#define NDR_ESTABLISHPOSITION (0x00)
+
+#define NDR_REQUESTCHALLENGE (0x01)
+
+#define NDR_WBEMLOGIN (0x02)
+
+#define NDR_NTLMLOGIN (0x03)
+
+#define NDR_IWBEMLEVEL1LOGIN_CALL_COUNT (4)
+void ndr_print_EstablishPosition(struct ndr_print *ndr, const char *name, int flags, const struct EstablishPosition *r);
+void ndr_print_RequestChallenge(struct ndr_print *ndr, const char *name, int flags, const struct RequestChallenge *r);
+void ndr_print_WBEMLogin(struct ndr_print *ndr, const char *name, int flags, const struct WBEMLogin *r);
+void ndr_print_NTLMLogin(struct ndr_print *ndr, const char *name, int flags, const struct NTLMLogin *r);
+#endif /* _HEADER_NDR_IWbemLevel1Login */
+#ifndef _HEADER_NDR_IWbemWCOSmartEnum
+#define _HEADER_NDR_IWbemWCOSmartEnum
+
+#define NDR_IWBEMWCOSMARTENUM_UUID "423ec01e-2e35-11d2-b604-00104b703efd"
+#define NDR_IWBEMWCOSMARTENUM_VERSION 0.0
+#define NDR_IWBEMWCOSMARTENUM_NAME "IWbemWCOSmartEnum"
+#define NDR_IWBEMWCOSMARTENUM_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IWbemWCOSmartEnum;
+#define NDR_IWBEMWCOSMARTENUM_NEXT (0x00)
+
+#define NDR_IWBEMWCOSMARTENUM_CALL_COUNT (1)
+void ndr_print_IWbemWCOSmartEnum_Next(struct ndr_print *ndr, const char *name, int flags, const struct IWbemWCOSmartEnum_Next *r);
+#endif /* _HEADER_NDR_IWbemWCOSmartEnum */
+#ifndef _HEADER_NDR_IWbemFetchSmartEnum
+#define _HEADER_NDR_IWbemFetchSmartEnum
+
+#define NDR_IWBEMFETCHSMARTENUM_UUID "1c1c45ee-4395-11d2-b60b-00104b703efd"
+#define NDR_IWBEMFETCHSMARTENUM_VERSION 0.0
+#define NDR_IWBEMFETCHSMARTENUM_NAME "IWbemFetchSmartEnum"
+#define NDR_IWBEMFETCHSMARTENUM_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IWbemFetchSmartEnum;
+#define NDR_FETCH (0x00)
+
+#define NDR_TEST (0x01)
+
+#define NDR_IWBEMFETCHSMARTENUM_CALL_COUNT (2)
+void ndr_print_Fetch(struct ndr_print *ndr, const char *name, int flags, const struct Fetch *r);
+void ndr_print_Test(struct ndr_print *ndr, const char *name, int flags, const struct Test *r);
+#endif /* _HEADER_NDR_IWbemFetchSmartEnum */
+#ifndef _HEADER_NDR_IWbemCallResult
+#define _HEADER_NDR_IWbemCallResult
+
+#define NDR_IWBEMCALLRESULT_UUID "44aca675-e8fc-11d0-a07c-00c04fb68820"
+#define NDR_IWBEMCALLRESULT_VERSION 0.0
+#define NDR_IWBEMCALLRESULT_NAME "IWbemCallResult"
+#define NDR_IWBEMCALLRESULT_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IWbemCallResult;
+#define NDR_GETRESULTOBJECT (0x00)
+
+#define NDR_GETRESULTSTRING (0x01)
+
+#define NDR_GETRESULTSERVICES (0x02)
+
+#define NDR_GETCALLSTATUS (0x03)
+
+#define NDR_IWBEMCALLRESULT_CALL_COUNT (4)
+void ndr_print_GetResultObject(struct ndr_print *ndr, const char *name, int flags, const struct GetResultObject *r);
+void ndr_print_GetResultString(struct ndr_print *ndr, const char *name, int flags, const struct GetResultString *r);
+void ndr_print_GetResultServices(struct ndr_print *ndr, const char *name, int flags, const struct GetResultServices *r);
+void ndr_print_GetCallStatus(struct ndr_print *ndr, const char *name, int flags, const struct GetCallStatus *r);
+#endif /* _HEADER_NDR_IWbemCallResult */
+#ifndef _HEADER_NDR_IWbemObjectSink
+#define _HEADER_NDR_IWbemObjectSink
+
+#define NDR_IWBEMOBJECTSINK_UUID "7c857801-7381-11cf-884d-00aa004b2e24"
+#define NDR_IWBEMOBJECTSINK_VERSION 0.0
+#define NDR_IWBEMOBJECTSINK_NAME "IWbemObjectSink"
+#define NDR_IWBEMOBJECTSINK_HELPSTRING NULL
+extern const struct ndr_interface_table ndr_table_IWbemObjectSink;
+#define NDR_SETSTATUS (0x00)
+
+#define NDR_INDICATE (0x01)
+
+#define NDR_IWBEMOBJECTSINK_CALL_COUNT (2)
+void ndr_print_SetStatus(struct ndr_print *ndr, const char *name, int flags, const struct SetStatus *r);
+void ndr_print_Indicate(struct ndr_print *ndr, const char *name, int flags, const struct Indicate *r);
+#endif /* _HEADER_NDR_IWbemObjectSink */
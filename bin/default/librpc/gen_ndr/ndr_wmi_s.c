@@ -0,0 +1,3 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_wmi.h"
+
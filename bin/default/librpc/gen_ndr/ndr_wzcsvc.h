@@ -0,0 +1,69 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/wzcsvc.h"
+
+#ifndef _HEADER_NDR_wzcsvc
+#define _HEADER_NDR_wzcsvc
+
+#define NDR_WZCSVC_UUID "621dff68-3c39-4c6c-aae3-e68e2c6503ad"
+#define NDR_WZCSVC_VERSION 1.0
+#define NDR_WZCSVC_NAME "wzcsvc"
+#define NDR_WZCSVC_HELPSTRING "Wireless Configuration Service"
+extern const struct ndr_interface_table ndr_table_wzcsvc;
+#define NDR_WZCSVC_ENUMINTERFACES (0x00)
+
+#define NDR_WZCSVC_QUERYINTERFACE (0x01)
+
+#define NDR_WZCSVC_SETINTERFACE (0x02)
+
+#define NDR_WZCSVC_REFRESHINTERFACE (0x03)
+
+#define NDR_WZCSVC_QUERYCONTEXT (0x04)
+
+#define NDR_WZCSVC_SETCONTEXT (0x05)
+
+#define NDR_WZCSVC_EAPOLUIRESPONSE (0x06)
+
+#define NDR_WZCSVC_EAPOLGETCUSTOMAUTHDATA (0x07)
+
+#define NDR_WZCSVC_EAPOLSETCUSTOMAUTHDATA (0x08)
+
+#define NDR_WZCSVC_EAPOLGETINTERFACEPARAMS (0x09)
+
+#define NDR_WZCSVC_EAPOLSETINTERFACEPARAMS (0x0a)
+
+#define NDR_WZCSVC_EAPOLREAUTHENTICATEINTERFACE (0x0b)
+
+#define NDR_WZCSVC_EAPOLQUERYINTERFACESTATE (0x0c)
+
+#define NDR_WZCSVC_OPENWZCDBLOGSESSION (0x0d)
+
+#define NDR_WZCSVC_CLOSEWZCDBLOGSESSION (0x0e)
+
+#define NDR_WZCSVC_ENUMWZCDBLOGRECORDS (0x0f)
+
+#define NDR_WZCSVC_FLUSHWZCDBLOG (0x10)
+
+#define NDR_WZCSVC_GETWZCDBLOGRECORD (0x11)
+
+#define NDR_WZCSVC_CALL_COUNT (18)
+void ndr_print_wzcsvc_EnumInterfaces(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EnumInterfaces *r);
+void ndr_print_wzcsvc_QueryInterface(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_QueryInterface *r);
+void ndr_print_wzcsvc_SetInterface(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_SetInterface *r);
+void ndr_print_wzcsvc_RefreshInterface(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_RefreshInterface *r);
+void ndr_print_wzcsvc_QueryContext(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_QueryContext *r);
+void ndr_print_wzcsvc_SetContext(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_SetContext *r);
+void ndr_print_wzcsvc_EapolUIResponse(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EapolUIResponse *r);
+void ndr_print_wzcsvc_EapolGetCustomAuthData(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EapolGetCustomAuthData *r);
+void ndr_print_wzcsvc_EapolSetCustomAuthData(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EapolSetCustomAuthData *r);
+void ndr_print_wzcsvc_EapolGetInterfaceParams(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EapolGetInterfaceParams *r);
+void ndr_print_wzcsvc_EapolSetInterfaceParams(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EapolSetInterfaceParams *r);
+void ndr_print_wzcsvc_EapolReAuthenticateInterface(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EapolReAuthenticateInterface *r);
+void ndr_print_wzcsvc_EapolQueryInterfaceState(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EapolQueryInterfaceState *r);
+void ndr_print_wzcsvc_OpenWZCDbLogSession(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_OpenWZCDbLogSession *r);
+void ndr_print_wzcsvc_CloseWZCDbLogSession(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_CloseWZCDbLogSession *r);
+void ndr_print_wzcsvc_EnumWZCDbLogRecords(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_EnumWZCDbLogRecords *r);
+void ndr_print_wzcsvc_FlushWZCdbLog(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_FlushWZCdbLog *r);
+void ndr_print_wzcsvc_GetWZCDbLogRecord(struct ndr_print *ndr, const char *name, int flags, const struct wzcsvc_GetWZCDbLogRecord *r);
+#endif /* _HEADER_NDR_wzcsvc */
@@ -0,0 +1,22 @@
+/* header auto-generated by pidl */
+
+#ifndef _PIDL_HEADER_scerpc
+#define _PIDL_HEADER_scerpc
+
+#include <stdint.h>
+
+#include "libcli/util/ntstatus.h"
+
+#ifndef _HEADER_scerpc
+#define _HEADER_scerpc
+
+
+struct scerpc_Unknown0 {
+	struct {
+		WERROR result;
+	} out;
+
+};
+
+#endif /* _HEADER_scerpc */
+#endif /* _PIDL_HEADER_scerpc */
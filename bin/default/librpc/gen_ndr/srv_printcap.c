@@ -0,0 +1,30 @@
+/*
+ * Unix SMB/CIFS implementation.
+ * server auto-generated by pidl. DO NOT MODIFY!
+ */
+
+#include "includes.h"
+#include "ntdomain.h"
+#include "bin/default/librpc/gen_ndr/srv_printcap.h"
+
+
+/* Tables */
+static struct api_struct api_printcap_cmds[] = 
+{
+};
+
+void printcap_get_pipe_fns(struct api_struct **fns, int *n_fns)
+{
+	*fns = api_printcap_cmds;
+	*n_fns = sizeof(api_printcap_cmds) / sizeof(struct api_struct);
+}
+
+NTSTATUS rpc_printcap_init(const struct rpc_srv_callbacks *rpc_srv_cb)
+{
+	return rpc_srv_register(SMB_RPC_INTERFACE_VERSION, "printcap", "printcap", &ndr_table_printcap, api_printcap_cmds, sizeof(api_printcap_cmds) / sizeof(struct api_struct), rpc_srv_cb);
+}
+
+NTSTATUS rpc_printcap_shutdown(void)
+{
+	return rpc_srv_unregister(&ndr_table_printcap);
+}
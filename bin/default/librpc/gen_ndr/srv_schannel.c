@@ -0,0 +1,30 @@
+/*
+ * Unix SMB/CIFS implementation.
+ * server auto-generated by pidl. DO NOT MODIFY!
+ */
+
+#include "includes.h"
+#include "ntdomain.h"
+#include "bin/default/librpc/gen_ndr/srv_schannel.h"
+
+
+/* Tables */
+static struct api_struct api_schannel_cmds[] = 
+{
+};
+
+void schannel_get_pipe_fns(struct api_struct **fns, int *n_fns)
+{
+	*fns = api_schannel_cmds;
+	*n_fns = sizeof(api_schannel_cmds) / sizeof(struct api_struct);
+}
+
+NTSTATUS rpc_schannel_init(const struct rpc_srv_callbacks *rpc_srv_cb)
+{
+	return rpc_srv_register(SMB_RPC_INTERFACE_VERSION, "schannel", "schannel", &ndr_table_schannel, api_schannel_cmds, sizeof(api_schannel_cmds) / sizeof(struct api_struct), rpc_srv_cb);
+}
+
+NTSTATUS rpc_schannel_shutdown(void)
+{
+	return rpc_srv_unregister(&ndr_table_schannel);
+}
@@ -0,0 +1,38 @@
+/* header auto-generated by pidl */
+
+#ifndef _PIDL_HEADER_w32time
+#define _PIDL_HEADER_w32time
+
+#include <stdint.h>
+
+#include "libcli/util/ntstatus.h"
+
+#ifndef _HEADER_w32time
+#define _HEADER_w32time
+
+
+struct w32time_SyncTime {
+	struct {
+		WERROR result;
+	} out;
+
+};
+
+
+struct w32time_GetNetLogonServiceBits {
+	struct {
+		WERROR result;
+	} out;
+
+};
+
+
+struct w32time_QueryProviderStatus {
+	struct {
+		WERROR result;
+	} out;
+
+};
+
+#endif /* _HEADER_w32time */
+#endif /* _PIDL_HEADER_w32time */
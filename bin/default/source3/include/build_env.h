@@ -0,0 +1,13 @@
+/* This file is automatically generated with "make include/build_env.h". DO NOT EDIT */
+
+#ifndef _BUILD_ENV_H
+#define _BUILD_ENV_H
+
+#define BUILD_ENV_UNAME "Linux vm 6.18.44-fc-v139 #1 SMP PREEMPT_DYNAMIC @0 x86_64 GNU/Linux"
+#define BUILD_ENV_DATE "Sun Oct 18 06:45:27 UTC 2026"
+#define BUILD_ENV_SRCDIR "/root/repo/source3"
+#define BUILD_ENV_BUILDDIR "/root/repo/source3"
+#define BUILD_ENV_USER "root"
+#define BUILD_ENV_HOST "vm"
+#define BUILD_ENV_COMPILER "/usr/bin/gcc"
+#endif /* _BUILD_ENV_H */